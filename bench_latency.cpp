@@ -0,0 +1,43 @@
+#include "custom_vector.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Сборка: g++ -std=c++20 -O2 bench_latency.cpp -o bench_latency
+// Гистограмма задержек push_back: обычный рост против постепенного
+std::vector<std::uint64_t> MeasureAppends(bool incremental, std::size_t count) {
+    std::vector<std::uint64_t> samples(count);
+    CustomVector<std::int64_t> vec;
+    if (incremental) {
+        vec.set_incremental_growth();
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        vec.push_back(static_cast<std::int64_t>(i));
+        auto finish = std::chrono::steady_clock::now();
+        samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    }
+    return samples;
+}
+
+std::uint64_t Percentile(const std::vector<std::uint64_t>& sorted, double fraction) {
+    std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+void Report(const char* mode, std::vector<std::uint64_t> samples) {
+    std::sort(samples.begin(), samples.end());
+    std::cout << mode << ": p50=" << Percentile(samples, 0.5) << "ns"
+              << " p99=" << Percentile(samples, 0.99) << "ns"
+              << " p99.9=" << Percentile(samples, 0.999) << "ns"
+              << " max=" << samples.back() << "ns\n";
+}
+
+signed main() {
+    const std::size_t count = 1 << 24;
+    Report("doubling   ", MeasureAppends(false, count));
+    Report("incremental", MeasureAppends(true, count));
+    return 0;
+}
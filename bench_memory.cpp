@@ -0,0 +1,56 @@
+#include "custom_vector.h"
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+// Сборка: g++ -std=c++20 -O2 bench_memory.cpp -o bench_memory
+// RSS процесса в мегабайтах (Linux, /proc/self/statm)
+double ResidentMb() {
+    std::ifstream statm("/proc/self/statm");
+    std::size_t total_pages = 0, resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return static_cast<double>(resident_pages) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+void Report(const char* stage, const CustomVector<int64_t>& vec) {
+    std::cout << "  " << stage << ": size=" << vec.size() << " capacity=" << vec.capacity()
+              << " rss=" << ResidentMb() << " MB\n";
+}
+
+void Burst(CustomVector<int64_t>& vec, std::size_t peak, std::size_t keep) {
+    for (std::size_t i = 0; i < peak; ++i) {
+        vec.push_back(static_cast<int64_t>(i));
+    }
+    Report("after burst", vec);
+    while (vec.size() > keep) {
+        vec.pop_back();
+    }
+    Report("after drain", vec);
+}
+
+signed main() {
+    const std::size_t peak = 1 << 24; // 128 MB int64_t
+    const std::size_t keep = 1 << 10;
+    std::cout << "baseline rss=" << ResidentMb() << " MB\n";
+    {
+        std::cout << "no shrink policy:\n";
+        CustomVector<int64_t> vec;
+        Burst(vec, peak, keep);
+    }
+    {
+        std::cout << "shrink policy (divisor 4):\n";
+        CustomVector<int64_t> vec;
+        vec.set_shrink_policy(4);
+        Burst(vec, peak, keep);
+        CustomVector<int64_t>::trim_heap();
+        Report("after trim_heap", vec);
+    }
+    {
+        std::cout << "discard_tail_pages:\n";
+        CustomVector<int64_t> vec;
+        Burst(vec, peak, keep);
+        vec.discard_tail_pages();
+        Report("after discard", vec);
+    }
+    return 0;
+}
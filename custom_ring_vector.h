@@ -0,0 +1,441 @@
+#ifndef CUSTOMRINGVECTOR_H
+#define CUSTOMRINGVECTOR_H
+
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <bit>
+
+// Кольцевой буфер: O(1) вставка и удаление с обоих концов.
+// Ёмкость всегда степень двойки, индекс в буфере — (head_ + i) & (capacity_ - 1)
+template <typename T>
+class CustomRingVector {
+private:
+    std::unique_ptr<T[]> data_;
+    std::size_t head_; // физический индекс первого элемента
+    std::size_t size_;
+    std::size_t capacity_;
+    bool overwrite_oldest_ = false;
+    std::size_t physical(std::size_t index) const { return (head_ + index) & (capacity_ - 1); }
+    void reallocation(std::size_t);
+    bool make_room_back();
+    bool make_room_front();
+public:
+    CustomRingVector();
+    // Как у CustomVector: n элементов, а не ёмкость; ёмкость задаётся через reserve()
+    explicit CustomRingVector(std::size_t);
+    CustomRingVector(std::size_t, const T&);
+    CustomRingVector(std::initializer_list<T>);
+
+    CustomRingVector(const CustomRingVector&); // копирование
+    CustomRingVector& operator=(const CustomRingVector&); // Присваивание копированием
+
+    CustomRingVector(CustomRingVector&& object); // Конструктор перемещения
+
+    CustomRingVector& operator=(CustomRingVector&&); // Присваивание с перемещением
+
+    std::size_t size() const;
+    bool empty() const;
+    std::size_t capacity() const;
+    void reserve(std::size_t new_cap);
+
+    // Ограниченный режим: буфер не растёт, при заполнении новый элемент вытесняет самый старый
+    // (push_back — с начала, push_front — с конца). Предел задаётся через reserve()
+    void set_overwrite_oldest(bool);
+
+    void push_back(const T&);
+    void push_front(const T&);
+
+    void pop_back();
+    void pop_front();
+
+    template <typename... Args>
+    T& emplace_back(Args&&...);
+
+    template <typename... Args>
+    T& emplace_front(Args&&...);
+
+    // Метод для доступа к элементу по логическому индексу
+
+    T& operator[](std::size_t);
+    const T& operator[](std::size_t) const;
+
+    T& at(std::size_t);
+    const T& at(std::size_t) const;
+
+    T& front();
+    const T& front() const;
+
+    T& back();
+    const T& back() const;
+
+    // Операции над парами итераторов — дружественные функции, поэтому Iterator и ConstIterator
+    // смешиваются в любом порядке. Сравниваются только логические индексы: итераторы разных контейнеров
+    // несравнимы, как в std
+    class ConstIterator;
+    class Iterator {
+    private:
+        CustomRingVector* ring;
+        std::size_t index; // логический индекс, обход кольца скрыт в operator[]
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        Iterator(): ring(nullptr), index(0) {}
+        Iterator(CustomRingVector* r, std::size_t i): ring(r), index(i) {}
+        T& operator*() const {
+            if (ring == nullptr) {
+                throw std::runtime_error("Try dereference nullptr");
+            }
+            return (*ring)[index];
+        }
+        T* operator->() const { return &(*ring)[index]; }
+        T& operator[](difference_type n) const { return (*ring)[index + n]; }
+        Iterator& operator++() { ++index; return *this; }
+        Iterator operator++(int) { Iterator temp = *this; ++index; return temp; }
+        Iterator& operator--() { --index; return *this; }
+        Iterator operator--(int) { Iterator temp = *this; --index; return temp; }
+        Iterator& operator+=(difference_type n) { index += n; return *this; }
+        Iterator& operator-=(difference_type n) { index -= n; return *this; }
+        Iterator operator+(difference_type n) const { return Iterator(ring, index + n); }
+        Iterator operator-(difference_type n) const { return Iterator(ring, index - n); }
+        friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index == b.index; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.index != b.index; }
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a.index < b.index; }
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a.index > b.index; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a.index <= b.index; }
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a.index >= b.index; }
+        friend ConstIterator;
+    };
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, size_); }
+
+    class ConstIterator {
+    private:
+        const CustomRingVector* ring;
+        std::size_t index;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+        ConstIterator(): ring(nullptr), index(0) {}
+        ConstIterator(const CustomRingVector* r, std::size_t i): ring(r), index(i) {}
+        ConstIterator(const Iterator& it): ring(it.ring), index(it.index) {}
+        const T& operator*() const {
+            if (ring == nullptr) {
+                throw std::runtime_error("Try dereference nullptr");
+            }
+            return (*ring)[index];
+        }
+        const T* operator->() const { return &(*ring)[index]; }
+        const T& operator[](difference_type n) const { return (*ring)[index + n]; }
+        ConstIterator& operator++() { ++index; return *this; }
+        ConstIterator operator++(int) { ConstIterator temp = *this; ++index; return temp; }
+        ConstIterator& operator--() { --index; return *this; }
+        ConstIterator operator--(int) { ConstIterator temp = *this; --index; return temp; }
+        ConstIterator& operator+=(difference_type n) { index += n; return *this; }
+        ConstIterator& operator-=(difference_type n) { index -= n; return *this; }
+        ConstIterator operator+(difference_type n) const { return ConstIterator(ring, index + n); }
+        ConstIterator operator-(difference_type n) const { return ConstIterator(ring, index - n); }
+        friend ConstIterator operator+(difference_type n, const ConstIterator& it) { return it + n; }
+        friend difference_type operator-(const ConstIterator& a, const ConstIterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+        friend bool operator==(const ConstIterator& a, const ConstIterator& b) { return a.index == b.index; }
+        friend bool operator!=(const ConstIterator& a, const ConstIterator& b) { return a.index != b.index; }
+        friend bool operator<(const ConstIterator& a, const ConstIterator& b) { return a.index < b.index; }
+        friend bool operator>(const ConstIterator& a, const ConstIterator& b) { return a.index > b.index; }
+        friend bool operator<=(const ConstIterator& a, const ConstIterator& b) { return a.index <= b.index; }
+        friend bool operator>=(const ConstIterator& a, const ConstIterator& b) { return a.index >= b.index; }
+    };
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, size_); }
+
+    void clear();
+    void swap(CustomRingVector&);
+};
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(): head_(0), size_(0), capacity_(0) {
+    data_ = std::make_unique<T[]>(0);
+}
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(std::size_t first_size): head_(0), size_(first_size) {
+    capacity_ = first_size == 0 ? 0 : std::bit_ceil(first_size);
+    data_ = std::make_unique<T[]>(capacity_);
+}
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(std::size_t new_size, const T& value): head_(0), size_(new_size) {
+    capacity_ = new_size == 0 ? 0 : std::bit_ceil(new_size);
+    data_ = std::make_unique<T[]>(capacity_);
+    for (std::size_t i = 0; i < new_size; ++i) {
+        data_[i] = value;
+    }
+}
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(std::initializer_list<T> ilist): head_(0), size_(ilist.size()) {
+    capacity_ = ilist.size() == 0 ? 0 : std::bit_ceil(ilist.size());
+    data_ = std::make_unique<T[]>(capacity_);
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+        data_[it - ilist.begin()] = *it;
+    }
+}
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(const CustomRingVector& other)
+    : head_(0), size_(other.size_), capacity_(other.capacity_), overwrite_oldest_(other.overwrite_oldest_) {
+    data_ = std::make_unique<T[]>(capacity_);
+    for (std::size_t i = 0; i < size_; ++i) {
+        data_[i] = other[i];
+    }
+}
+
+template <typename T>
+CustomRingVector<T>& CustomRingVector<T>::operator=(const CustomRingVector& other) {
+    if (this != &other) {
+        head_ = 0;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        overwrite_oldest_ = other.overwrite_oldest_;
+        data_ = std::make_unique<T[]>(capacity_);
+        for (std::size_t i = 0; i < size_; ++i) {
+            data_[i] = other[i];
+        }
+    }
+    return *this;
+}
+
+template <typename T>
+CustomRingVector<T>::CustomRingVector(CustomRingVector&& object)
+    : data_(std::move(object.data_)), head_(object.head_), size_(object.size_),
+      capacity_(object.capacity_), overwrite_oldest_(object.overwrite_oldest_) {
+    object.data_ = std::make_unique<T[]>(0);
+    object.head_ = 0;
+    object.size_ = 0;
+    object.capacity_ = 0;
+}
+
+template <typename T>
+CustomRingVector<T>& CustomRingVector<T>::operator=(CustomRingVector&& object) {
+    if (this != &object) {
+        data_ = std::move(object.data_);
+        head_ = object.head_;
+        size_ = object.size_;
+        capacity_ = object.capacity_;
+        overwrite_oldest_ = object.overwrite_oldest_;
+        object.data_ = std::make_unique<T[]>(0);
+        object.head_ = 0;
+        object.size_ = 0;
+        object.capacity_ = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+std::size_t CustomRingVector<T>::size() const {
+    return size_;
+}
+
+template <typename T>
+bool CustomRingVector<T>::empty() const {
+    return size_ == 0;
+}
+
+template <typename T>
+std::size_t CustomRingVector<T>::capacity() const {
+    return capacity_;
+}
+
+template <typename T>
+void CustomRingVector<T>::reserve(std::size_t new_cap) {
+    if (new_cap > capacity_) {
+        reallocation(std::bit_ceil(new_cap));
+    }
+}
+
+template <typename T>
+void CustomRingVector<T>::set_overwrite_oldest(bool overwrite_oldest) {
+    overwrite_oldest_ = overwrite_oldest;
+}
+
+template <typename T>
+void CustomRingVector<T>::reallocation(std::size_t new_capacity) {
+    // Содержимое выпрямляется один раз: после роста первый элемент снова лежит в начале буфера
+    std::unique_ptr<T[]> new_data_ = std::make_unique<T[]>(new_capacity);
+    for (std::size_t i = 0; i < size_; ++i) {
+        new_data_[i] = std::move(data_[physical(i)]);
+    }
+    data_ = std::move(new_data_);
+    head_ = 0;
+    capacity_ = new_capacity;
+}
+
+// Возвращает false, если место освобождено вытеснением (размер не меняется).
+// emplace_back/emplace_front сначала конструируют значение: аргументы могут ссылаться на элементы,
+// которые рост переместит или вытеснение перезапишет.
+// Удаление сбрасывает элемент в T(), чтобы освободить его ресурсы; для тривиальных типов шаг пропускается
+template <typename T>
+bool CustomRingVector<T>::make_room_back() {
+    if (size_ < capacity_) {
+        return true;
+    }
+    if (overwrite_oldest_ && capacity_ > 0) {
+        head_ = physical(1);
+        return false;
+    }
+    reallocation(capacity_ == 0 ? 1 : capacity_ * 2);
+    return true;
+}
+
+template <typename T>
+bool CustomRingVector<T>::make_room_front() {
+    if (size_ < capacity_) {
+        return true;
+    }
+    if (overwrite_oldest_ && capacity_ > 0) {
+        return false; // новый первый элемент займёт место последнего
+    }
+    reallocation(capacity_ == 0 ? 1 : capacity_ * 2);
+    return true;
+}
+
+template <typename T>
+void CustomRingVector<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T>
+void CustomRingVector<T>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+template <typename T>
+template <typename... Args>
+T& CustomRingVector<T>::emplace_back(Args&& ... args) {
+    T value(std::forward<Args>(args)...);
+    if (make_room_back()) {
+        ++size_;
+    }
+    T& slot = data_[physical(size_ - 1)];
+    slot = std::move(value);
+    return slot;
+}
+
+template <typename T>
+template <typename... Args>
+T& CustomRingVector<T>::emplace_front(Args&& ... args) {
+    T value(std::forward<Args>(args)...);
+    if (make_room_front()) {
+        ++size_;
+    }
+    head_ = (head_ - 1) & (capacity_ - 1);
+    T& slot = data_[head_];
+    slot = std::move(value);
+    return slot;
+}
+
+template <typename T>
+void CustomRingVector<T>::pop_back() {
+    if (size_ == 0) {
+        return;
+    }
+    --size_;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        data_[physical(size_)] = T();
+    }
+}
+
+template <typename T>
+void CustomRingVector<T>::pop_front() {
+    if (size_ == 0) {
+        return;
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        data_[head_] = T();
+    }
+    head_ = physical(1);
+    --size_;
+}
+
+template <typename T>
+T& CustomRingVector<T>::operator[](std::size_t index) {
+    return data_[physical(index)];
+}
+
+template <typename T>
+const T& CustomRingVector<T>::operator[](std::size_t index) const {
+    return data_[physical(index)];
+}
+
+template <typename T>
+T& CustomRingVector<T>::at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("Index is out of range");
+    }
+    return (*this)[index];
+}
+
+template <typename T>
+const T& CustomRingVector<T>::at(std::size_t index) const {
+    if (index >= size_) {
+        throw std::out_of_range("Index is out of range");
+    }
+    return (*this)[index];
+}
+
+template <typename T>
+T& CustomRingVector<T>::front() {
+    return data_[head_];
+}
+
+template <typename T>
+const T& CustomRingVector<T>::front() const {
+    return data_[head_];
+}
+
+template <typename T>
+T& CustomRingVector<T>::back() {
+    return (*this)[size_ - 1];
+}
+
+template <typename T>
+const T& CustomRingVector<T>::back() const {
+    return (*this)[size_ - 1];
+}
+
+template <typename T>
+void CustomRingVector<T>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = 0; i < size_; ++i) {
+            (*this)[i] = T();
+        }
+    }
+    head_ = 0;
+    size_ = 0;
+}
+
+template <typename T>
+void CustomRingVector<T>::swap(CustomRingVector& other) {
+    data_.swap(other.data_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(overwrite_oldest_, other.overwrite_oldest_);
+}
+#endif
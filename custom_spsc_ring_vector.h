@@ -0,0 +1,101 @@
+#ifndef CUSTOMSPSCRINGVECTOR_H
+#define CUSTOMSPSCRINGVECTOR_H
+
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <memory>
+#include <atomic>
+#include <bit>
+
+// Кольцевой буфер фиксированной ёмкости без блокировок для одного писателя и одного читателя.
+// try_push вызывает только поток-писатель, try_pop — только поток-читатель
+template <typename T>
+class CustomSpscRingVector {
+private:
+    static constexpr std::size_t kCacheLine = 64;
+    std::unique_ptr<T[]> data_;
+    std::size_t capacity_;
+    // Счётчики растут монотонно, индекс в буфере — счётчик & (capacity_ - 1).
+    // Разнесены по кэш-линиям, чтобы писатель и читатель не делили одну линию
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0}; // пишет только писатель
+    std::size_t cached_head_ = 0; // последний увиденный писателем head_
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0}; // пишет только читатель
+    std::size_t cached_tail_ = 0; // последний увиденный читателем tail_
+public:
+    explicit CustomSpscRingVector(std::size_t); // ёмкость, округляется до степени двойки
+
+    CustomSpscRingVector(const CustomSpscRingVector&) = delete;
+    CustomSpscRingVector& operator=(const CustomSpscRingVector&) = delete;
+
+    std::size_t capacity() const;
+    // Приблизительные значения, если другой поток в это время работает с буфером
+    std::size_t size() const;
+    bool empty() const;
+
+    bool try_push(const T&);
+    bool try_push(T&&);
+    bool try_pop(T&);
+};
+
+template <typename T>
+CustomSpscRingVector<T>::CustomSpscRingVector(std::size_t first_capacity) {
+    if (first_capacity == 0) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+    capacity_ = std::bit_ceil(first_capacity);
+    data_ = std::make_unique<T[]>(capacity_);
+}
+
+template <typename T>
+std::size_t CustomSpscRingVector<T>::capacity() const {
+    return capacity_;
+}
+
+template <typename T>
+std::size_t CustomSpscRingVector<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template <typename T>
+bool CustomSpscRingVector<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+bool CustomSpscRingVector<T>::try_push(const T& value) {
+    T copy = value;
+    return try_push(std::move(copy));
+}
+
+template <typename T>
+bool CustomSpscRingVector<T>::try_push(T&& value) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == capacity_) {
+        // Перечитываем head_ только когда буфер выглядит полным
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == capacity_) {
+            return false;
+        }
+    }
+    data_[tail & (capacity_ - 1)] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool CustomSpscRingVector<T>::try_pop(T& value) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            return false;
+        }
+    }
+    value = std::move(data_[head & (capacity_ - 1)]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+#endif
@@ -6,21 +6,81 @@
 #include <stdexcept>
 #include <iterator>
 #include <memory>
+#include <type_traits>
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 template <typename T>
 class CustomVector {
+public:
+    // Буфер может быть получен извне (adopt), поэтому освобождается сохранённым вместе с ним deleter:
+    // без free_fn — delete[], иначе free_fn(ptr, context). Два указателя вместо стирания типа
+    class BufferDeleter {
+    private:
+        void (*free_fn_)(T*, void*) = nullptr;
+        void* context_ = nullptr;
+    public:
+        BufferDeleter() = default;
+        BufferDeleter(std::default_delete<T[]>) {} // для буферов из std::make_unique
+        BufferDeleter(void (*free_fn)(T*, void*), void* context = nullptr): free_fn_(free_fn), context_(context) {}
+        void operator()(T* ptr) const {
+            if (free_fn_ == nullptr) {
+                delete[] ptr;
+            } else {
+                free_fn_(ptr, context_);
+            }
+        }
+    };
+    using deleter_type = BufferDeleter;
+
+    struct ReleasedBuffer {
+        std::unique_ptr<T[], deleter_type> data;
+        std::size_t size;
+        std::size_t capacity;
+    };
 private:
-    std::unique_ptr<T[]> data_;
+    std::unique_ptr<T[], deleter_type> data_;
     std::size_t size_;
     std::size_t capacity_;
+    std::size_t shrink_divisor_ = 0; // 0 — политика сжатия выключена
+    std::size_t min_capacity_ = 0;
+    // Незавершённый постепенный рост: элементы [migrated, old_size) ещё лежат в old_data.
+    // Хранится отдельно и существует только во время переноса, чтобы обычный вектор платил одной проверкой указателя
+    struct Migration {
+        std::unique_ptr<T[], deleter_type> old_data;
+        std::size_t migrated;
+        std::size_t old_size;
+        std::uintptr_t discarded_upto; // страницы old_data ниже этого адреса уже отданы ОС
+    };
+    static constexpr std::size_t kDiscardChunk = 64 * 1024; // байт перенесённых страниц на один madvise
+    std::unique_ptr<Migration> migration_;
+    std::size_t migration_step_ = 0; // 0 — обычный рост с полным копированием
     void reallocation(std::size_t);
+    void maybe_shrink();
+    void grow();
+    void migrate(std::size_t count);
+    void finish_migration();
+    void check_no_migration() const;
+    static std::size_t page_size();
+    static std::size_t discard_pages(std::uintptr_t begin, std::uintptr_t end);
 public:
+    class ConstIterator;
+
     CustomVector();
     CustomVector(std::size_t);
     CustomVector(std::size_t, const T&);
 
     CustomVector(const CustomVector&); // копирование
     CustomVector(std::initializer_list<T>);
+    CustomVector(ConstIterator first, ConstIterator last);
     CustomVector& operator=(const CustomVector&); // Присваивание копированием
 
     CustomVector(CustomVector&& object); // Конструктор перемещения 
@@ -31,6 +91,19 @@ public:
 
     void assign(std::size_t count, const T& value);
     void assign(std::initializer_list<T> ilist);
+    void assign(ConstIterator first, ConstIterator last);
+
+    // Передача буфера без копирования. adopt забирает ptr с capacity сконструированными элементами,
+    // из которых первые size считаются живыми; освобождается он вызовом deleter(ptr).
+    // release отдаёт буфер с его deleter, размером и ёмкостью и оставляет вектор пустым
+    void adopt(T* ptr, std::size_t size, std::size_t capacity, deleter_type deleter = deleter_type());
+    ReleasedBuffer release();
+
+    // Только для lvalue: span от временного вектора указывал бы на освобождённую память
+    operator std::span<T>() &;
+    operator std::span<const T>() const&;
+    operator std::span<T>() && = delete;
+    operator std::span<const T>() const&& = delete;
 
     std::size_t size() const;
     bool empty() const;
@@ -38,6 +111,38 @@ public:
     void reserve(std::size_t new_cap);
     void shrink_to_fit();
 
+    // Сжатие с гистерезисом: буфер уменьшается до 2 * size(), когда size() * shrink_divisor <= capacity().
+    // shrink_divisor > 2, иначе сразу после сжатия снова понадобится рост.
+    // Политика относится к содержимому: копируется, перемещается и обменивается (swap) вместе с ним.
+    // С включённой политикой pop_back, erase, resize и clear могут перевыделить буфер и тогда
+    // делают недействительными все итераторы, указатели и ссылки, в том числе до места удаления
+    void set_shrink_policy(std::size_t shrink_divisor, std::size_t min_capacity = 16);
+    void disable_shrink_policy();
+
+    // Отдаёт ОС свободную память кучи процесса (malloc_trim на glibc, иначе ничего не делает).
+    // Обходит все арены под их блокировками, поэтому вызывается явно, а не из сжатия:
+    // буферы меньше порога mmap после освобождения остаются в куче
+    static void trim_heap();
+
+    // Возвращает ОС страницы хвоста [size(), capacity()) без перемещения данных (только для trivially copyable T).
+    // После вызова значения в хвосте не определены. Возвращает число освобождённых байт.
+    std::size_t discard_tail_pages();
+
+    // Постепенный рост: при заполнении выделяется новый буфер, а старые элементы переносятся
+    // по migration_step штук за каждую следующую операцию, поэтому push_back не копирует весь вектор разом.
+    // Для trivially copyable T перенесённые страницы старого буфера отдаются ОС порциями по 64 КБ,
+    // поэтому его освобождение в конце переноса не зависит от размера вектора, а пик памяти близок к новому буферу.
+    // Граница действует, если конструктор по умолчанию и деструктор T тривиальны. Неconst data(), begin(), end()
+    // и модифицирующие операции кроме push_back/emplace_back/pop_back завершают перенос целиком.
+    // const begin()/end() ничего не переносят: во время переноса итераторы читают элементы через operator[].
+    // const data(), а с ним преобразование в std::span<const T> и CustomVectorView требуют непрерывного буфера
+    // и бросают std::logic_error, пока перенос идёт; перед передачей вектора по const-ссылке вызывайте finish_growth().
+    // Настройка переходит вместе с содержимым при копировании, перемещении и обмене
+    void set_incremental_growth(std::size_t migration_step = 4);
+    void disable_incremental_growth();
+    // Завершает незавершённый перенос целиком
+    void finish_growth();
+
     void push_back(const T&);
 
     void pop_back();
@@ -61,7 +166,6 @@ public:
     const T* data() const;
 
 
-    class ConstIterator;
     class Iterator {
     private:
         T* ptr;
@@ -98,37 +202,45 @@ public:
         if (data_ == nullptr) {
             throw std::runtime_error("Try take  operator from nullptr structure");
         }
+        finish_migration();
         return Iterator(data_.get());
     }
     Iterator end() {
         if (data_ == nullptr) {
             throw std::runtime_error("Try take  operator from nullptr structure");
         }
+        finish_migration();
         return Iterator(data_.get() + size_);
     }
 
     class ConstIterator {
     private:
         const T* ptr;
+        // Задан, если итератор создан во время переноса: тогда ptr лишь задаёт индекс,
+        // а элемент читается через operator[] вектора из того буфера, где он сейчас лежит
+        const CustomVector* owner;
     public:
         using difference_type = std::ptrdiff_t; 
-        explicit ConstIterator(const T* p):ptr(p) {}; // чтобы не дать случайно преобразовать из T* в ConstIterator
+        explicit ConstIterator(const T* p, const CustomVector* o = nullptr):ptr(p), owner(o) {}; // чтобы не дать случайно преобразовать из T* в ConstIterator
         const T& operator*() const {
             if (ptr == nullptr) {
                 throw std::runtime_error("Try dereference nullptr");
             }
+            if (owner != nullptr) {
+                return (*owner)[ptr - owner->data_.get()];
+            }
             return *ptr;
         }
-        ConstIterator(const Iterator& it): ptr(it.ptr) {}
-        const T* operator->() const {return ptr;}
+        ConstIterator(const Iterator& it): ptr(it.ptr), owner(nullptr) {}
+        const T* operator->() const {return &**this;}
         ConstIterator& operator++() {++ptr; return *this;}
         ConstIterator operator++(int) { ConstIterator temp = *this; ++ptr; return temp; }
         ConstIterator& operator--() { --ptr; return *this; }
         ConstIterator operator--(int) { ConstIterator temp = *this; --ptr; return temp; }
         ConstIterator& operator+=(difference_type n) { ptr += n; return *this; }
         ConstIterator& operator-=(difference_type n) { ptr -= n; return *this; }
-        ConstIterator operator+(difference_type n) const { return ConstIterator(ptr + n); }
-        ConstIterator operator-(difference_type n) const { return ConstIterator(ptr - n); }
+        ConstIterator operator+(difference_type n) const { return ConstIterator(ptr + n, owner); }
+        ConstIterator operator-(difference_type n) const { return ConstIterator(ptr - n, owner); }
         difference_type operator-(const ConstIterator& other) const { return ptr - other.ptr; }
         bool operator==(const ConstIterator& other) const { return ptr == other.ptr; }
         bool operator!=(const ConstIterator& other) const { return ptr != other.ptr; }
@@ -140,10 +252,10 @@ public:
 
 
     ConstIterator begin() const {
-        return Iterator(data_.get());
+        return ConstIterator(data_.get(), migration_ != nullptr ? this : nullptr);
     }
     ConstIterator end() const {
-        return Iterator(data_.get() + size_);
+        return ConstIterator(data_.get() + size_, migration_ != nullptr ? this : nullptr);
     }
     Iterator insert(ConstIterator, const T&);
     Iterator erase(Iterator pos);
@@ -183,10 +295,12 @@ CustomVector<T>::CustomVector(std::size_t new_size, const T& value) {
 }
 
 template <typename T>
-CustomVector<T>::CustomVector(const CustomVector& other): size_(other.size_), capacity_(other.capacity_) {
+CustomVector<T>::CustomVector(const CustomVector& other)
+    : size_(other.size_), capacity_(other.capacity_), shrink_divisor_(other.shrink_divisor_), min_capacity_(other.min_capacity_),
+      migration_step_(other.migration_step_) {
     data_ = std::make_unique<T[]>(capacity_);
     for (std::size_t i = 0; i < size_; ++i) {
-        data_[i] = other.data_[i];
+        data_[i] = other[i];
     }
 }
 
@@ -200,14 +314,28 @@ CustomVector<T>::CustomVector(std::initializer_list<T>ilist){
     }
 }
 
+template <typename T>
+CustomVector<T>::CustomVector(ConstIterator first, ConstIterator last) {
+    size_ = last - first;
+    capacity_ = size_;
+    data_ = std::make_unique<T[]>(capacity_);
+    for (std::size_t i = 0; i < size_; ++i, ++first) {
+        data_[i] = *first;
+    }
+}
+
 template <typename T>
 CustomVector<T>& CustomVector<T>::operator=(const CustomVector& other) {
     if (this != &other) {
+        finish_migration();
         size_ = other.size_;
         capacity_ = other.capacity_;
+        shrink_divisor_ = other.shrink_divisor_;
+        min_capacity_ = other.min_capacity_;
+        migration_step_ = other.migration_step_;
         data_ = std::make_unique<T[]>(capacity_);
         for (std::size_t i = 0; i < size_; ++i) {
-            data_[i] = other.data_[i];
+            data_[i] = other[i];
         }
     }
     return *this;
@@ -215,25 +343,47 @@ CustomVector<T>& CustomVector<T>::operator=(const CustomVector& other) {
 
 template <typename T>
 CustomVector<T>::CustomVector(CustomVector&& object) {
+    object.finish_migration();
     size_ = object.size_;
     capacity_ = object.capacity_;
-    data_ = object.data_;
-    object.data_ = nullptr;
+    shrink_divisor_ = object.shrink_divisor_;
+    min_capacity_ = object.min_capacity_;
+    migration_step_ = object.migration_step_;
+    data_ = std::move(object.data_);
+    // Источник остаётся пустым вектором с настройками по умолчанию и пригоден для дальнейшей работы
+    object.data_ = std::make_unique<T[]>(0);
+    object.size_ = 0;
+    object.capacity_ = 0;
+    object.shrink_divisor_ = 0;
+    object.min_capacity_ = 0;
+    object.migration_step_ = 0;
 }
 
 template<typename T>
 CustomVector<T>& CustomVector<T>::operator=(CustomVector&& object) {
+    if (this == &object) {
+        return *this;
+    }
+    migration_.reset();
+    object.finish_migration();
     size_ = object.size_;
     capacity_ = object.capacity_;
+    shrink_divisor_ = object.shrink_divisor_;
+    min_capacity_ = object.min_capacity_;
+    migration_step_ = object.migration_step_;
     data_ = std::move(object.data_);
-    object.data_ = nullptr;
+    object.data_ = std::make_unique<T[]>(0);
     object.size_ = 0;
     object.capacity_ = 0;
+    object.shrink_divisor_ = 0;
+    object.min_capacity_ = 0;
+    object.migration_step_ = 0;
     return *this;
 }
 
 template<typename T>
 CustomVector<T>& CustomVector<T>::operator=(std::initializer_list<T> ilist) {
+    finish_migration();
     size_ = ilist.size();
     capacity_ = ilist.size();
     data_ = std::make_unique<T[]>(capacity_);
@@ -244,6 +394,7 @@ CustomVector<T>& CustomVector<T>::operator=(std::initializer_list<T> ilist) {
 }
 template <typename T>
 void CustomVector<T>::assign(std::size_t count, const T& value) {
+    finish_migration();
     capacity_ = count;
     size_ = count;
     data_ = std::make_unique<T[]>(count);
@@ -254,6 +405,7 @@ void CustomVector<T>::assign(std::size_t count, const T& value) {
 
 template <typename T>
 void CustomVector<T>::assign(std::initializer_list<T> ilist) {
+    finish_migration();
     size_ = ilist.size();
     capacity_ = ilist.size();
     data_ = std::make_unique<T[]>(capacity_);
@@ -262,6 +414,54 @@ void CustomVector<T>::assign(std::initializer_list<T> ilist) {
     }
 }
 
+template <typename T>
+void CustomVector<T>::assign(ConstIterator first, ConstIterator last) {
+    finish_migration();
+    // Диапазон может лежать в собственном буфере, поэтому старый освобождается только после копирования
+    std::size_t count = last - first;
+    std::unique_ptr<T[]> new_data_ = std::make_unique<T[]>(count);
+    for (std::size_t i = 0; i < count; ++i, ++first) {
+        new_data_[i] = *first;
+    }
+    data_ = std::move(new_data_);
+    size_ = count;
+    capacity_ = count;
+}
+
+template <typename T>
+void CustomVector<T>::adopt(T* ptr, std::size_t size, std::size_t capacity, deleter_type deleter) {
+    if (size > capacity) {
+        throw std::invalid_argument("Adopted size exceeds capacity");
+    }
+    if (ptr == nullptr) {
+        throw std::invalid_argument("Try adopt nullptr buffer");
+    }
+    finish_migration();
+    data_ = std::unique_ptr<T[], deleter_type>(ptr, std::move(deleter));
+    size_ = size;
+    capacity_ = capacity;
+}
+
+template <typename T>
+typename CustomVector<T>::ReleasedBuffer CustomVector<T>::release() {
+    finish_migration();
+    ReleasedBuffer released{std::move(data_), size_, capacity_};
+    data_ = std::make_unique<T[]>(0);
+    size_ = 0;
+    capacity_ = 0;
+    return released;
+}
+
+template <typename T>
+CustomVector<T>::operator std::span<T>() & {
+    return std::span<T>(data(), size_);
+}
+
+template <typename T>
+CustomVector<T>::operator std::span<const T>() const& {
+    return std::span<const T>(data(), size_);
+}
+
 template <typename T>
 std::size_t CustomVector<T>::size() const {
     return size_;
@@ -286,11 +486,163 @@ void CustomVector<T>::reserve(std::size_t new_cap) {
 
 template <typename T>
 void CustomVector<T>::shrink_to_fit() {
-    reallocation(size_);
+    if (size_ != capacity_) {
+        reallocation(size_);
+    }
+}
+
+template <typename T>
+void CustomVector<T>::set_shrink_policy(std::size_t shrink_divisor, std::size_t min_capacity) {
+    if (shrink_divisor <= 2) {
+        throw std::invalid_argument("Shrink divisor must be greater than 2");
+    }
+    shrink_divisor_ = shrink_divisor;
+    min_capacity_ = min_capacity;
+    maybe_shrink();
+}
+
+template <typename T>
+void CustomVector<T>::disable_shrink_policy() {
+    shrink_divisor_ = 0;
+}
+
+template <typename T>
+void CustomVector<T>::maybe_shrink() {
+    if (shrink_divisor_ == 0 || capacity_ <= min_capacity_) {
+        return;
+    }
+    if (size_ * shrink_divisor_ <= capacity_) {
+        // После сжатия заполнена половина буфера: до роста и до следующего сжатия одинаково далеко
+        reallocation(std::max(size_ * 2, min_capacity_));
+    }
+}
+
+template <typename T>
+void CustomVector<T>::trim_heap() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+template <typename T>
+std::size_t CustomVector<T>::page_size() {
+#if defined(__linux__)
+    static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return page;
+#else
+    return 4096;
+#endif
+}
+
+// Отдаёт ОС только целые страницы, полностью лежащие в [begin, end); возвращает их объём в байтах
+template <typename T>
+std::size_t CustomVector<T>::discard_pages(std::uintptr_t begin, std::uintptr_t end) {
+#if defined(__linux__)
+    const std::size_t page = page_size();
+    const std::uintptr_t first = (begin + page - 1) / page * page;
+    const std::uintptr_t last = end / page * page;
+    if (first >= last) {
+        return 0;
+    }
+    if (madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED) != 0) {
+        return 0;
+    }
+    return last - first;
+#else
+    (void)begin;
+    (void)end;
+    return 0;
+#endif
+}
+
+template <typename T>
+std::size_t CustomVector<T>::discard_tail_pages() {
+    static_assert(std::is_trivially_copyable_v<T>, "discard_tail_pages requires trivially copyable T");
+    finish_migration();
+    return discard_pages(reinterpret_cast<std::uintptr_t>(data_.get() + size_),
+                         reinterpret_cast<std::uintptr_t>(data_.get() + capacity_));
+}
+
+template <typename T>
+void CustomVector<T>::set_incremental_growth(std::size_t migration_step) {
+    if (migration_step == 0) {
+        throw std::invalid_argument("Migration step must be positive");
+    }
+    migration_step_ = migration_step;
+}
+
+template <typename T>
+void CustomVector<T>::disable_incremental_growth() {
+    finish_migration();
+    migration_step_ = 0;
+}
+
+template <typename T>
+void CustomVector<T>::grow() {
+    std::size_t new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
+    if (migration_step_ == 0) {
+        reallocation(new_capacity);
+        return;
+    }
+    // Перенос прошлого роста к этому моменту уже завершён: за old_size операций
+    // переносится не меньше old_size элементов, а до заполнения нового буфера их столько же
+    finish_migration();
+    std::unique_ptr<T[], deleter_type> old_data = std::move(data_);
+    data_ = std::make_unique_for_overwrite<T[]>(new_capacity);
+    capacity_ = new_capacity;
+    if (size_ > 0) {
+        std::uintptr_t start = reinterpret_cast<std::uintptr_t>(old_data.get());
+        migration_ = std::make_unique<Migration>(Migration{std::move(old_data), 0, size_, start});
+    }
+}
+
+template <typename T>
+void CustomVector<T>::migrate(std::size_t count) {
+    if (migration_ == nullptr) {
+        return;
+    }
+    Migration& state = *migration_;
+    std::size_t stop = std::min(state.old_size, state.migrated + count);
+    for (; state.migrated < stop; ++state.migrated) {
+        data_[state.migrated] = std::move(state.old_data[state.migrated]);
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // Перенесённые страницы старого буфера отдаются ОС порциями, чтобы итоговое освобождение
+        // не снимало отображение десятков мегабайт внутри одного push_back
+        std::uintptr_t migrated_end = reinterpret_cast<std::uintptr_t>(state.old_data.get() + state.migrated);
+        if (migrated_end - state.discarded_upto >= kDiscardChunk) {
+            discard_pages(state.discarded_upto, migrated_end);
+            // Страница с границей переноса отдаётся в следующий раз, когда перенесётся целиком
+            state.discarded_upto = migrated_end / page_size() * page_size();
+        }
+    }
+    if (state.migrated == state.old_size) {
+        migration_.reset();
+    }
+}
+
+template <typename T>
+void CustomVector<T>::finish_growth() {
+    finish_migration();
+}
+
+template <typename T>
+void CustomVector<T>::finish_migration() {
+    if (migration_ != nullptr) {
+        migrate(migration_->old_size);
+    }
+}
+
+template <typename T>
+void CustomVector<T>::check_no_migration() const {
+    if (migration_ != nullptr) {
+        throw std::logic_error("Contiguous const access during incremental growth");
+    }
 }
 
 template <typename T>
 void CustomVector<T>::reallocation(std::size_t new_capacity) {
+    finish_migration();
     std::unique_ptr<T[]>new_data_ = std::make_unique<T[]>(new_capacity);
     for (std::size_t i = 0; i < size_; ++i) {
         new_data_[i] = std::move(data_[i]);
@@ -301,27 +653,46 @@ void CustomVector<T>::reallocation(std::size_t new_capacity) {
 template <typename T>
 void CustomVector<T>::push_back(const T& value) {
     if (size_ == capacity_) {
-        reallocation(capacity_ == 0? 1: capacity_ * 2);
+        grow();
     }
     data_[size_] = value;
     ++size_;
+    migrate(migration_step_);
 }
 
 template <typename T>
 void CustomVector<T>::pop_back() {
-    data_[size_] = T();
-    if (size_ > 0) {
-        --size_;
+    if (size_ == 0) {
+        return;
+    }
+    --size_;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        (*this)[size_] = T(); // освобождаем ресурсы удалённого элемента
+    }
+    if (migration_ != nullptr && migration_->old_size > size_) {
+        migration_->old_size = std::max(size_, migration_->migrated);
     }
+    migrate(migration_step_);
+    maybe_shrink();
 }
 
 template <typename T>
 T& CustomVector<T>::operator[](std::size_t index) {
+    if (migration_ != nullptr) [[unlikely]] {
+        if (index >= migration_->migrated && index < migration_->old_size) {
+            return migration_->old_data[index];
+        }
+    }
     return data_[index];
 }
 
 template <typename T>
 const T& CustomVector<T>::operator[](std::size_t index) const {
+    if (migration_ != nullptr) [[unlikely]] {
+        if (index >= migration_->migrated && index < migration_->old_size) {
+            return migration_->old_data[index];
+        }
+    }
     return data_[index];
 } 
 
@@ -330,7 +701,7 @@ T& CustomVector<T>::at(std::size_t index) {
     if (index >= size_) {
         throw std::out_of_range("Index is out of range");
     }
-    return data_[index];
+    return (*this)[index];
 }
 
 template<typename T>
@@ -338,36 +709,38 @@ const T& CustomVector<T>::at(std::size_t index) const {
     if (index >= size_) {
         throw std::out_of_range("Index is out of range");
     }
-    return data_[index];
+    return (*this)[index];
 }
 
 template<typename T>
 T& CustomVector<T>::front() {
-    return data_[0];
+    return (*this)[0];
 }
 
 template<typename T>
 const T& CustomVector<T>::front() const {
-    return data_[0];
+    return (*this)[0];
 }
 
 template<typename T>
 T& CustomVector<T>::back() {
-    return data_[size_ - 1];
+    return (*this)[size_ - 1];
 }
 
 template<typename T>
 const T& CustomVector<T>::back() const {
-    return data_[size_ - 1];
+    return (*this)[size_ - 1];
 }
 
 template<typename T>
 T* CustomVector<T>::data() {
+    finish_migration();
     return data_.get();
 }
 
 template<typename T>
 const T* CustomVector<T>::data() const {
+    check_no_migration();
     return data_.get();
 }
 
@@ -392,6 +765,7 @@ typename CustomVector<T>::Iterator CustomVector<T>::erase(typename CustomVector<
         data_[i] = std::move(data_[i + 1]);
     }
     size_--;
+    maybe_shrink();
     return typename CustomVector<T>::Iterator(data_.get() + index);
 }
 
@@ -414,15 +788,17 @@ template <typename T>
 template <typename... Args>
 T& CustomVector<T>::emplace_back(Args&& ... args) {
     if (size_ == capacity_) {
-        reallocation(capacity_ == 0? 1: capacity_ * 2);
+        grow();
     }
     data_[size_] = T(std::forward<Args>(args)...);
     ++size_;
-    return data_[size_];
+    migrate(migration_step_);
+    return data_[size_ - 1];
 }
 
 template <typename T>
 void CustomVector<T>::resize(std::size_t new_size) {
+    finish_migration();
     if (data_ == nullptr) {
         capacity_ = new_size;
         size_ = new_size;
@@ -433,10 +809,12 @@ void CustomVector<T>::resize(std::size_t new_size) {
         reallocation(new_size);
     }
     size_ = new_size;
+    maybe_shrink();
 }
 
 template <typename T>
 void CustomVector<T>::resize(std::size_t new_size, const T&value) {
+    finish_migration();
     if (data_ == nullptr) {
         capacity_ = new_size;
         size_ = new_size;
@@ -453,20 +831,29 @@ void CustomVector<T>::resize(std::size_t new_size, const T&value) {
         }
     }
     size_ = new_size;
+    maybe_shrink();
 }
 
 template <typename  T>
 void CustomVector<T>::clear() {
-    for (std::size_t i = 0; i < size_; ++i) {
-        data_[i] = T();
+    finish_migration();
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = 0; i < size_; ++i) {
+            data_[i] = T();
+        }
     }
     size_ = 0;
+    maybe_shrink();
 }
 
 template <typename T>
 void CustomVector<T>::swap(CustomVector&other) {
     std::swap(capacity_,other.capacity_);
     std::swap(size_,other.size_);
+    std::swap(shrink_divisor_,other.shrink_divisor_);
+    std::swap(min_capacity_,other.min_capacity_);
     data_.swap(other.data_);
+    migration_.swap(other.migration_);
+    std::swap(migration_step_,other.migration_step_);
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef CUSTOMVECTORVIEW_H
+#define CUSTOMVECTORVIEW_H
+
+#include "custom_vector.h"
+#include <cstddef>
+#include <stdexcept>
+#include <span>
+#include <algorithm>
+
+// Невладеющее представление непрерывного диапазона. Итераторы — CustomVector<T>::ConstIterator,
+// поэтому представление подходит везде, где CustomVector принимает ConstIterator
+template <typename T>
+class CustomVectorView {
+private:
+    const T* data_;
+    std::size_t size_;
+public:
+    using ConstIterator = typename CustomVector<T>::ConstIterator;
+
+    CustomVectorView(): data_(nullptr), size_(0) {}
+    CustomVectorView(const T* data, std::size_t size): data_(data), size_(size) {}
+    CustomVectorView(const CustomVector<T>& vec): data_(vec.data()), size_(vec.size()) {}
+    CustomVectorView(const CustomVector<T>&&) = delete; // представление временного вектора сразу повисло бы
+    CustomVectorView(std::span<const T> span): data_(span.data()), size_(span.size()) {}
+
+    operator std::span<const T>() const { return std::span<const T>(data_, size_); }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T* data() const { return data_; }
+
+    const T& operator[](std::size_t index) const { return data_[index]; }
+    const T& at(std::size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index is out of range");
+        }
+        return data_[index];
+    }
+    const T& front() const { return data_[0]; }
+    const T& back() const { return data_[size_ - 1]; }
+
+    // Поддиапазон [offset, offset + count), count обрезается по концу представления
+    CustomVectorView subview(std::size_t offset, std::size_t count) const {
+        if (offset > size_) {
+            throw std::out_of_range("Offset is out of range");
+        }
+        return CustomVectorView(data_ + offset, std::min(count, size_ - offset));
+    }
+
+    ConstIterator begin() const { return ConstIterator(data_); }
+    ConstIterator end() const { return ConstIterator(data_ + size_); }
+};
+#endif
@@ -1,8 +1,18 @@
 #include "custom_vector.h"
+#include "custom_ring_vector.h"
+#include "custom_spsc_ring_vector.h"
+#include "custom_vector_view.h"
 #include <iostream>
 #include <cassert>
 #include <stdexcept>
 #include <vector>
+#include <string>
+#include <deque>
+#include <thread>
+#include <cstdlib>
+#include <span>
+#include <iterator>
+#include <unistd.h>
 void TestAccessOperator() {
     try {
         CustomVector<int64_t> vec(3, 5);
@@ -104,6 +114,189 @@ void TestReserveAndShrinkToFit() {
     }
 }
 
+void TestShrinkPolicy() {
+    try {
+        CustomVector<int> vec;
+        vec.set_shrink_policy(4, 4);
+        for (int i = 0; i < 64; ++i) {
+            vec.push_back(i);
+        }
+        if (vec.capacity() != 64) {
+            throw std::runtime_error("Wrong capacity after push");
+        }
+        while (vec.size() > 16) {
+            vec.pop_back();
+        }
+        if (vec.capacity() != 32) {
+            throw std::runtime_error("Vector not shrink below threshold");
+        }
+        // Гистерезис: колебания вокруг порога не вызывают перевыделений
+        const int* before = vec.data();
+        for (int i = 0; i < 10; ++i) {
+            vec.push_back(i);
+            vec.pop_back();
+        }
+        if (vec.data() != before || vec.capacity() != 32) {
+            throw std::runtime_error("Vector reallocate near threshold");
+        }
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            if (vec[i] != static_cast<int>(i)) {
+                throw std::runtime_error("Wrong value after shrink");
+            }
+        }
+        vec.clear();
+        if (vec.size() != 0 || vec.capacity() != 4) {
+            throw std::runtime_error("Wrong capacity after clear");
+        }
+        // Политика переходит вместе с содержимым при копировании, перемещении и обмене
+        for (int i = 0; i < 64; ++i) {
+            vec.push_back(i);
+        }
+        CustomVector<int> copy = vec;
+        CustomVector<int> moved = std::move(copy);
+        CustomVector<int> swapped;
+        swapped.swap(moved);
+        swapped.resize(8);
+        if (swapped.capacity() != 16) {
+            throw std::runtime_error("Shrink policy lost after copy, move or swap");
+        }
+        if (moved.capacity() != 0) {
+            throw std::runtime_error("Swap moved capacity incorrectly");
+        }
+        try {
+            vec.set_shrink_policy(2);
+            throw std::runtime_error("No exception for shrink divisor without hysteresis");
+        } catch(const std::invalid_argument&) {
+        }
+        std::cout << "TestShrinkPolicy passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestShrinkPolicy failed: " << e.what() << std::endl;
+    }
+}
+
+void TestDiscardTailPages() {
+    try {
+        CustomVector<int64_t> vec(1 << 20, 7);
+        vec.resize(100);
+        const int64_t* before = vec.data();
+        std::size_t discarded = vec.discard_tail_pages();
+        const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        if (discarded == 0 || discarded % page != 0) {
+            throw std::runtime_error("Discard returned wrong byte count");
+        }
+        if (vec.data() != before || vec.capacity() != (1 << 20)) {
+            throw std::runtime_error("Buffer moved after discard");
+        }
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            if (vec[i] != 7) {
+                throw std::runtime_error("Live elements changed after discard");
+            }
+        }
+        vec.push_back(8);
+        if (vec.back() != 8) {
+            throw std::runtime_error("Wrong value after push into discarded tail");
+        }
+        std::cout << "TestDiscardTailPages passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestDiscardTailPages failed: " << e.what() << std::endl;
+    }
+}
+
+void TestIncrementalGrowth() {
+    try {
+        CustomVector<int> vec;
+        vec.set_incremental_growth(2);
+        std::vector<int> expected;
+        for (int i = 0; i < 1000; ++i) {
+            vec.push_back(i);
+            expected.push_back(i);
+            if (i % 7 == 0) {
+                vec.pop_back();
+                expected.pop_back();
+            }
+            // Чтение во время переноса видит элементы из обоих буферов
+            for (std::size_t j = 0; j < expected.size(); j += 37) {
+                if (vec[j] != expected[j]) {
+                    throw std::runtime_error("Wrong value during migration");
+                }
+            }
+        }
+        if (vec.size() != expected.size()) {
+            throw std::runtime_error("Wrong vector size after incremental growth");
+        }
+        std::size_t index = 0;
+        for (auto it = vec.begin(); it != vec.end(); ++it, ++index) {
+            if (*it != expected[index]) {
+                throw std::runtime_error("Wrong value after incremental growth");
+            }
+        }
+        CustomVector<std::string> words;
+        words.set_incremental_growth(1);
+        for (int i = 0; i < 100; ++i) {
+            words.emplace_back(std::to_string(i));
+        }
+        CustomVector<std::string> copy = words;
+        if (copy.back() != "99" || copy.front() != "0" || words.at(50) != "50") {
+            throw std::runtime_error("Wrong copy during migration");
+        }
+        // Рост с 64 до 128 начал перенос; const-доступ к непрерывному буферу его не трогает
+        CustomVector<int> pending;
+        pending.set_incremental_growth(1);
+        for (int i = 0; i < 65; ++i) {
+            pending.push_back(i);
+        }
+        const CustomVector<int>& cref = pending;
+        int expected_value = 0;
+        for (const int& value : cref) {
+            if (value != expected_value++) {
+                throw std::runtime_error("Wrong const iteration during migration");
+            }
+        }
+        if (expected_value != 65 || *(cref.begin() + 10) != 10) {
+            throw std::runtime_error("Const iteration missed elements during migration");
+        }
+        try {
+            cref.data();
+            throw std::runtime_error("No exception for const data during migration");
+        } catch(const std::logic_error&) {
+        }
+        // Обмен переносит и незавершённый перенос, и его шаг
+        CustomVector<int> other;
+        other.swap(pending);
+        for (int i = 0; i < 64; ++i) {
+            other.push_back(65 + i);
+        }
+        if (cref.size() != 0 || other.size() != 129 || other[64] != 64 || other[128] != 128) {
+            throw std::runtime_error("Wrong values after swap during migration");
+        }
+        if (static_cast<const CustomVector<int>&>(other).begin() != other.begin()) {
+            throw std::runtime_error("Migration not finished by pushes after swap");
+        }
+        // finish_growth завершает перенос без дальнейших вставок
+        CustomVector<int64_t> large;
+        large.set_incremental_growth(1);
+        for (int i = 0; i < (1 << 17) + 50000; ++i) {
+            large.push_back(i);
+        }
+        // Половина старого буфера уже перенесена и отдана ОС; остальное читается из него
+        for (std::size_t i = 0; i < large.size(); ++i) {
+            if (large[i] != static_cast<int64_t>(i)) {
+                throw std::runtime_error("Wrong value after discarding migrated pages");
+            }
+        }
+        large.finish_growth();
+        const CustomVector<int64_t>& large_cref = large;
+        for (std::size_t i = 0; i < large.size(); ++i) {
+            if (large_cref.data()[i] != static_cast<int64_t>(i)) {
+                throw std::runtime_error("Wrong value after finish_growth");
+            }
+        }
+        std::cout << "TestIncrementalGrowth passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestIncrementalGrowth failed: " << e.what() << std::endl;
+    }
+}
+
 void TestResizeMethod() {
     try {
         CustomVector<int> vec(3, 5);
@@ -124,6 +317,30 @@ void TestResizeMethod() {
     }
 }
 
+void TestMoveMethod() {
+    try {
+        CustomVector<int> a = {1, 2, 3, 4, 5, 6, 7, 8};
+        CustomVector<int> b = std::move(a);
+        if (b.size() != 8 || b[7] != 8 || a.size() != 0 || a.capacity() != 0) {
+            throw std::runtime_error("Wrong state after move construct");
+        }
+        a.push_back(10);
+        a.push_back(20);
+        if (a.size() != 2 || a[1] != 20 || a.begin() + 2 != a.end()) {
+            throw std::runtime_error("Moved-from vector unusable");
+        }
+        CustomVector<int> c;
+        c = std::move(b);
+        b.push_back(30);
+        if (c.size() != 8 || c[0] != 1 || b.size() != 1 || b[0] != 30) {
+            throw std::runtime_error("Wrong state after move assign");
+        }
+        std::cout << "TestMoveMethod passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestMoveMethod failed: " << e.what() << std::endl;
+    }
+}
+
 void TestInsertMethod() {
     try {
         CustomVector<int>a;
@@ -261,17 +478,244 @@ void TestMatrix() {
          std::cout << "TestMatrix failed: " << e.what() << std::endl;
     }
 }
+static_assert(std::random_access_iterator<CustomRingVector<int>::Iterator>);
+static_assert(std::random_access_iterator<CustomRingVector<int>::ConstIterator>);
+
+void TestRingVector() {
+    try {
+        CustomRingVector<int> a;
+        std::deque<int> b;
+        // Очередь со сдвигом головы: элементы переходят через границу буфера
+        for (int i = 0; i < 100; ++i) {
+            a.push_back(i);
+            b.push_back(i);
+            if (i % 3 == 0) {
+                a.pop_front();
+                b.pop_front();
+            }
+            if (i % 5 == 0) {
+                a.push_front(-i);
+                b.push_front(-i);
+            }
+            if (i % 7 == 0) {
+                a.pop_back();
+                b.pop_back();
+            }
+        }
+        if (a.size() != b.size()) {
+            throw std::runtime_error("Ring vector has wrong size");
+        }
+        if ((a.capacity() & (a.capacity() - 1)) != 0) {
+            throw std::runtime_error("Ring vector capacity is not a power of two");
+        }
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i]) {
+                throw std::runtime_error("Ring vector has wrong value");
+            }
+        }
+        auto it = a.begin();
+        it += 10;
+        if (*it != b[10] || it - a.begin() != 10 || a.end() - a.begin() != static_cast<std::ptrdiff_t>(b.size())) {
+            throw std::runtime_error("Ring vector iterator is wrong");
+        }
+        CustomRingVector<int>::ConstIterator cit = a.begin();
+        if (!(2 + a.begin() == cit + 2) || !(cit + 2 == 2 + a.begin()) || !(cit < a.end()) || !(a.begin() < cit + 1)) {
+            throw std::runtime_error("Mixed iterator comparison is wrong");
+        }
+        // Конструктор от числа означает количество элементов, как у CustomVector
+        CustomRingVector<int> sized(5, 7);
+        if (CustomRingVector<int>(5).size() != CustomVector<int>(5).size() || sized.size() != 5 || sized.back() != 7) {
+            throw std::runtime_error("Ring vector size constructor differs from CustomVector");
+        }
+        if (a.front() != b.front() || a.back() != b.back()) {
+            throw std::runtime_error("Ring vector has wrong front or back");
+        }
+        std::cout << "TestRingVector passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestRingVector failed: " << e.what() << std::endl;
+    }
+}
+
+void TestRingVectorOverwrite() {
+    try {
+        CustomRingVector<std::string> a;
+        a.reserve(3);
+        a.set_overwrite_oldest(true);
+        for (int i = 0; i < 10; ++i) {
+            a.push_back(std::to_string(i));
+        }
+        if (a.size() != 4 || a.capacity() != 4) {
+            throw std::runtime_error("Bounded ring vector grows");
+        }
+        std::vector<std::string> expected = {"6", "7", "8", "9"};
+        std::size_t index = 0;
+        for (auto it = a.begin(); it != a.end(); ++it, ++index) {
+            if (*it != expected[index]) {
+                throw std::runtime_error("Bounded ring vector keeps wrong elements");
+            }
+        }
+        a.push_front("5");
+        if (a.front() != "5" || a.back() != "8" || a.size() != 4) {
+            throw std::runtime_error("Bounded push_front overwrites wrong element");
+        }
+        std::cout << "TestRingVectorOverwrite passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestRingVectorOverwrite failed: " << e.what() << std::endl;
+    }
+}
+
+void TestSpscRingVector() {
+    try {
+        const int count = 100000;
+        CustomSpscRingVector<int> queue(64);
+        std::thread producer([&queue]() {
+            for (int i = 0; i < count; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        // Ошибку только запоминаем: без вычитывания писатель висел бы на полной очереди и join не вернулся бы
+        bool reordered = false;
+        int received = 0;
+        while (received < count) {
+            int value;
+            if (!queue.try_pop(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (value != received) {
+                reordered = true;
+            }
+            ++received;
+        }
+        producer.join();
+        if (reordered) {
+            throw std::runtime_error("SPSC ring vector reorders elements");
+        }
+        if (!queue.empty()) {
+            throw std::runtime_error("SPSC ring vector is not empty");
+        }
+        std::cout << "TestSpscRingVector passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestSpscRingVector failed: " << e.what() << std::endl;
+    }
+}
+// Собственный deleter — два указателя, а не std::function
+static_assert(sizeof(CustomVector<int>::deleter_type) == 2 * sizeof(void*));
+
+void TestAdoptRelease() {
+    try {
+        // Буфер из C API: выделен malloc, освобождается free
+        int* raw = static_cast<int*>(std::malloc(8 * sizeof(int)));
+        for (int i = 0; i < 8; ++i) {
+            raw[i] = i * 10;
+        }
+        CustomVector<int> vec;
+        CustomVector<int>::deleter_type free_deleter([](int* ptr, void*) { std::free(ptr); });
+        vec.adopt(raw, 5, 8, free_deleter);
+        if (vec.data() != raw || vec.size() != 5 || vec.capacity() != 8 || vec[4] != 40) {
+            throw std::runtime_error("Adopted buffer copied or wrong");
+        }
+        vec.push_back(50);
+        if (vec.data() != raw || vec.back() != 50) {
+            throw std::runtime_error("Push into adopted buffer reallocate");
+        }
+        auto released = vec.release();
+        if (released.data.get() != raw || released.size != 6 || released.capacity != 8) {
+            throw std::runtime_error("Release returned wrong buffer description");
+        }
+        if (vec.size() != 0 || vec.capacity() != 0) {
+            throw std::runtime_error("Release copied buffer or left vector non empty");
+        }
+        vec.push_back(1);
+        if (vec.size() != 1 || vec[0] != 1) {
+            throw std::runtime_error("Vector unusable after release");
+        }
+        CustomVector<int> other;
+        other.adopt(released.data.release(), released.size, released.capacity, free_deleter);
+        if (other[5] != 50) {
+            throw std::runtime_error("Buffer lost values between vectors");
+        }
+        try {
+            other.adopt(nullptr, 0, 1);
+            throw std::runtime_error("No exception for nullptr adopt");
+        } catch(const std::invalid_argument&) {
+        }
+        std::cout << "TestAdoptRelease passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestAdoptRelease failed: " << e.what() << std::endl;
+    }
+}
+
+static_assert(std::is_convertible_v<CustomVector<int>&, std::span<int>>);
+static_assert(std::is_convertible_v<const CustomVector<int>&, std::span<const int>>);
+static_assert(!std::is_convertible_v<CustomVector<int>, std::span<int>>);
+static_assert(!std::is_convertible_v<CustomVector<int>, std::span<const int>>);
+static_assert(!std::is_constructible_v<CustomVectorView<int>, CustomVector<int>>);
+
+int SumSpan(std::span<const int> values) {
+    int sum = 0;
+    for (int value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+void TestSpanAndView() {
+    try {
+        CustomVector<int> vec = {1, 2, 3, 4, 5};
+        std::span<int> span = vec;
+        span[0] = 10;
+        if (vec[0] != 10 || span.size() != vec.size()) {
+            throw std::runtime_error("Span does not alias vector");
+        }
+        const CustomVector<int>& cref = vec;
+        if (SumSpan(cref) != 24) {
+            throw std::runtime_error("Wrong sum over const span");
+        }
+        CustomVectorView<int> view = vec;
+        CustomVectorView<int> middle = view.subview(1, 3);
+        if (middle.size() != 3 || middle.front() != 2 || middle.back() != 4) {
+            throw std::runtime_error("Wrong subview");
+        }
+        CustomVector<int> copy(middle.begin(), middle.end());
+        if (copy.size() != 3 || copy[2] != 4) {
+            throw std::runtime_error("Wrong vector from view iterators");
+        }
+        vec.assign(middle.begin(), middle.end());
+        if (vec.size() != 3 || vec[0] != 2 || vec[2] != 4) {
+            throw std::runtime_error("Wrong assign from own view");
+        }
+        vec.insert(vec.begin(), 7);
+        if (SumSpan(CustomVectorView<int>(vec)) != 16) {
+            throw std::runtime_error("Wrong sum over view");
+        }
+        std::cout << "TestSpanAndView passed!\n";
+    } catch(const std::runtime_error&e) {
+         std::cout << "TestSpanAndView failed: " << e.what() << std::endl;
+    }
+}
 
 signed main() {
     TestAccessOperator();
     TestAtMethod();
     TestPushBackPopBackMethods();
     TestReserveAndShrinkToFit();
+    TestShrinkPolicy();
+    TestDiscardTailPages();
+    TestIncrementalGrowth();
     TestResizeMethod();
+    TestMoveMethod();
     TestInsertMethod();
     TestEraseMethod();
     TestSwapMethod();
     TestEmplace();
     TestMatrix();
+    TestRingVector();
+    TestRingVectorOverwrite();
+    TestSpscRingVector();
+    TestAdoptRelease();
+    TestSpanAndView();
     return 0;
 }
\ No newline at end of file